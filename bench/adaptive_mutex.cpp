@@ -29,7 +29,12 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include <locking/adaptive_mutex.hpp>
 
@@ -54,3 +59,83 @@ static void adaptive_mutex_lock(benchmark::State &state) {
     }
 }
 BENCHMARK(adaptive_mutex_lock);
+
+static void adaptive_mutex_oversubscribed_lock(benchmark::State &state) {
+    static locking::AdaptiveMutex<> mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ mutex };
+
+        for (int i = 0; i < 64; ++i) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+}
+BENCHMARK(adaptive_mutex_oversubscribed_lock)
+    ->Threads(static_cast<int>(std::thread::hardware_concurrency()) * 4)
+    ->UseRealTime();
+
+// each thread records how long every acquisition took; once all threads are
+// done, thread 0 merges the samples and reports the median and 99.9th
+// percentile over every acquisition
+template <typename P>
+static void adaptive_mutex_acquisition_latency(benchmark::State &state) {
+    using Clock = std::chrono::steady_clock;
+
+    static locking::AdaptiveMutex<std::mutex, Clock, P> mutex;
+    static std::vector<std::vector<Clock::duration>> samples;
+
+    if (state.thread_index() == 0) {
+        samples.assign(static_cast<std::size_t>(state.threads()), {});
+    }
+
+    for (auto _ : state) {
+        const auto start = Clock::now();
+        [[maybe_unused]] std::scoped_lock lock{ mutex };
+        samples[static_cast<std::size_t>(state.thread_index())].push_back(
+            Clock::now() - start
+        );
+
+        for (int i = 0; i < 64; ++i) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+
+    if (state.thread_index() != 0) {
+        return;
+    }
+
+    std::vector<Clock::duration> latencies;
+
+    for (const auto &thread_samples : samples) {
+        latencies.insert(latencies.end(), thread_samples.begin(),
+                         thread_samples.end());
+    }
+
+    samples.clear();
+
+    if (latencies.empty()) {
+        return;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    const auto percentile = [&latencies](double p) {
+        const auto index = static_cast<std::size_t>(
+            p * static_cast<double>(latencies.size() - 1)
+        );
+
+        return std::chrono::duration<double, std::nano>{
+            latencies[index]
+        }.count();
+    };
+
+    state.counters["p50_ns"] = percentile(0.5);
+    state.counters["p999_ns"] = percentile(0.999);
+}
+BENCHMARK_TEMPLATE(adaptive_mutex_acquisition_latency, locking::BargingPolicy)
+    ->ThreadRange(2, static_cast<int>(std::thread::hardware_concurrency()) * 4)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(adaptive_mutex_acquisition_latency, locking::StarvationPolicy)
+    ->ThreadRange(2, static_cast<int>(std::thread::hardware_concurrency()) * 4)
+    ->UseRealTime();
@@ -0,0 +1,136 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#include <memory>
+#include <thread>
+
+#ifdef __cpp_lib_barrier
+#include <barrier>
+#endif
+
+#include <locking/barrier.hpp>
+
+#include <benchmark/benchmark.h>
+
+static void barrier_arrive_and_wait(benchmark::State &state) {
+    static std::unique_ptr<locking::Barrier<>> barrier;
+
+    if (state.thread_index() == 0) {
+        barrier = std::make_unique<locking::Barrier<>>(state.threads());
+    }
+
+    for (auto _ : state) {
+        barrier->arrive_and_wait();
+    }
+
+    if (state.thread_index() == 0) {
+        barrier.reset();
+    }
+}
+BENCHMARK(barrier_arrive_and_wait)
+    ->ThreadRange(2, static_cast<int>(std::thread::hardware_concurrency()) * 2)
+    ->UseRealTime();
+
+static void barrier_completion(benchmark::State &state) {
+    struct Completion {
+        int *phases;
+
+        void operator()() noexcept {
+            benchmark::DoNotOptimize(++*phases);
+        }
+    };
+
+    static int phases = 0;
+    static std::unique_ptr<locking::Barrier<Completion>> barrier;
+
+    if (state.thread_index() == 0) {
+        barrier = std::make_unique<locking::Barrier<Completion>>(
+            state.threads(), Completion{ &phases }
+        );
+    }
+
+    for (auto _ : state) {
+        barrier->arrive_and_wait();
+    }
+
+    if (state.thread_index() == 0) {
+        barrier.reset();
+    }
+}
+BENCHMARK(barrier_completion)
+    ->ThreadRange(2, static_cast<int>(std::thread::hardware_concurrency()) * 2)
+    ->UseRealTime();
+
+static void combining_barrier_arrive_and_wait(benchmark::State &state) {
+    static std::unique_ptr<locking::CombiningBarrier<>> barrier;
+
+    if (state.thread_index() == 0) {
+        barrier = std::make_unique<locking::CombiningBarrier<>>(state.threads());
+    }
+
+    const auto participant = static_cast<std::size_t>(state.thread_index());
+
+    for (auto _ : state) {
+        barrier->arrive_and_wait(participant);
+    }
+
+    if (state.thread_index() == 0) {
+        barrier.reset();
+    }
+}
+BENCHMARK(combining_barrier_arrive_and_wait)
+    ->ThreadRange(2, static_cast<int>(std::thread::hardware_concurrency()) * 2)
+    ->UseRealTime();
+
+#ifdef __cpp_lib_barrier
+static void std_barrier_arrive_and_wait(benchmark::State &state) {
+    static std::unique_ptr<std::barrier<>> barrier;
+
+    if (state.thread_index() == 0) {
+        barrier = std::make_unique<std::barrier<>>(state.threads());
+    }
+
+    for (auto _ : state) {
+        barrier->arrive_and_wait();
+    }
+
+    if (state.thread_index() == 0) {
+        barrier.reset();
+    }
+}
+BENCHMARK(std_barrier_arrive_and_wait)
+    ->ThreadRange(2, static_cast<int>(std::thread::hardware_concurrency()) * 2)
+    ->UseRealTime();
+#endif
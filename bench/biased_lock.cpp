@@ -0,0 +1,117 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <locking/adaptive_mutex.hpp>
+#include <locking/biased_lock.hpp>
+#include <locking/spinlock.hpp>
+
+#include <benchmark/benchmark.h>
+
+static void biased_lock_default_ctor(benchmark::State &state) {
+    for (auto _ : state) {
+        [[maybe_unused]] locking::BiasedLock<> mutex;
+        benchmark::DoNotOptimize(mutex);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(biased_lock_default_ctor);
+
+static void biased_lock_lock(benchmark::State &state) {
+    locking::BiasedLock<> mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ mutex };
+        benchmark::DoNotOptimize(lock);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(biased_lock_lock);
+
+static void biased_spinlock_lock(benchmark::State &state) {
+    locking::BiasedLock<locking::Spinlock> mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ mutex };
+        benchmark::DoNotOptimize(lock);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(biased_spinlock_lock);
+
+// with an active owner, thread 0 takes the lock every iteration and the others
+// every 64th. thread 0 owns the bias, so each background acquisition revokes
+// it only once and the owner is back on its fast path for the iterations in
+// between. with an exited owner, the bias goes to a thread that locks once and
+// exits before the loop, and every benchmark thread locks every iteration
+template <typename M>
+static void mixed_lock(benchmark::State &state) {
+    static std::unique_ptr<M> mutex;
+
+    const bool is_owner_active = state.range(0) != 0;
+
+    if (state.thread_index() == 0) {
+        mutex = std::make_unique<M>();
+
+        if (!is_owner_active) {
+            std::thread{ [] { std::scoped_lock lock{ *mutex }; } }.join();
+        }
+    }
+
+    int i = 0;
+
+    for (auto _ : state) {
+        if (!is_owner_active || state.thread_index() == 0 || ++i % 64 == 0) {
+            [[maybe_unused]] std::scoped_lock lock{ *mutex };
+            benchmark::DoNotOptimize(lock);
+            benchmark::ClobberMemory();
+        }
+    }
+
+    if (state.thread_index() == 0) {
+        mutex.reset();
+    }
+}
+BENCHMARK_TEMPLATE(mixed_lock, locking::BiasedLock<>)
+    ->ArgName("owner_active")->Arg(1)->Arg(0)
+    ->Threads(1)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(mixed_lock, locking::BiasedLock<locking::Spinlock>)
+    ->ArgName("owner_active")->Arg(1)->Arg(0)
+    ->Threads(1)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(mixed_lock, locking::Spinlock)
+    ->ArgName("owner_active")->Arg(1)->Arg(0)
+    ->Threads(1)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(mixed_lock, locking::AdaptiveMutex<>)
+    ->ArgName("owner_active")->Arg(1)->Arg(0)
+    ->Threads(1)->Threads(2)->UseRealTime();
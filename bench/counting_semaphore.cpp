@@ -0,0 +1,105 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#ifdef __cpp_lib_semaphore
+#include <semaphore>
+#endif
+
+#include <locking/counting_semaphore.hpp>
+
+#include <benchmark/benchmark.h>
+
+static void counting_semaphore_release_acquire(benchmark::State &state) {
+    locking::CountingSemaphore<> semaphore{ 0 };
+
+    for (auto _ : state) {
+        semaphore.release();
+        semaphore.acquire();
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(counting_semaphore_release_acquire);
+
+// two threads hand a token back and forth, so each iteration is a round trip
+static void counting_semaphore_ping_pong(benchmark::State &state) {
+    static locking::CountingSemaphore<> ping{ 0 };
+    static locking::CountingSemaphore<> pong{ 0 };
+
+    auto &give = (state.thread_index() == 0) ? ping : pong;
+    auto &take = (state.thread_index() == 0) ? pong : ping;
+
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            give.release();
+            take.acquire();
+        } else {
+            take.acquire();
+            give.release();
+        }
+    }
+}
+BENCHMARK(counting_semaphore_ping_pong)->Threads(2)->UseRealTime();
+
+#ifdef __cpp_lib_semaphore
+static void std_counting_semaphore_release_acquire(benchmark::State &state) {
+    std::counting_semaphore<> semaphore{ 0 };
+
+    for (auto _ : state) {
+        semaphore.release();
+        semaphore.acquire();
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(std_counting_semaphore_release_acquire);
+
+static void std_counting_semaphore_ping_pong(benchmark::State &state) {
+    static std::counting_semaphore<> ping{ 0 };
+    static std::counting_semaphore<> pong{ 0 };
+
+    auto &give = (state.thread_index() == 0) ? ping : pong;
+    auto &take = (state.thread_index() == 0) ? pong : ping;
+
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            give.release();
+            take.acquire();
+        } else {
+            take.acquire();
+            give.release();
+        }
+    }
+}
+BENCHMARK(std_counting_semaphore_ping_pong)->Threads(2)->UseRealTime();
+#endif
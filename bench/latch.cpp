@@ -0,0 +1,62 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#ifdef __cpp_lib_latch
+#include <latch>
+#endif
+
+#include <locking/latch.hpp>
+
+#include <benchmark/benchmark.h>
+
+static void latch_arrive_and_wait(benchmark::State &state) {
+    for (auto _ : state) {
+        locking::Latch<> latch{ 1 };
+        latch.arrive_and_wait();
+        benchmark::DoNotOptimize(latch);
+    }
+}
+BENCHMARK(latch_arrive_and_wait);
+
+#ifdef __cpp_lib_latch
+static void std_latch_arrive_and_wait(benchmark::State &state) {
+    for (auto _ : state) {
+        std::latch latch{ 1 };
+        latch.arrive_and_wait();
+        benchmark::DoNotOptimize(latch);
+    }
+}
+BENCHMARK(std_latch_arrive_and_wait);
+#endif
@@ -30,6 +30,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 #include <mutex>
+#include <thread>
 
 #include <benchmark/benchmark.h>
 
@@ -52,3 +53,18 @@ static void mutex_lock(benchmark::State &state) {
     }
 }
 BENCHMARK(mutex_lock);
+
+static void mutex_oversubscribed_lock(benchmark::State &state) {
+    static std::mutex mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ mutex };
+
+        for (int i = 0; i < 64; ++i) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+}
+BENCHMARK(mutex_oversubscribed_lock)
+    ->Threads(static_cast<int>(std::thread::hardware_concurrency()) * 4)
+    ->UseRealTime();
@@ -0,0 +1,158 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include <locking/adaptive_mutex.hpp>
+#include <locking/pi_mutex.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+static void pi_mutex_default_ctor(benchmark::State &state) {
+    for (auto _ : state) {
+        [[maybe_unused]] locking::PiMutex mutex;
+        benchmark::DoNotOptimize(mutex);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(pi_mutex_default_ctor);
+
+static void pi_mutex_lock(benchmark::State &state) {
+    locking::PiMutex mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ mutex };
+        benchmark::DoNotOptimize(lock);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(pi_mutex_lock);
+
+static void adaptive_pi_mutex_lock(benchmark::State &state) {
+    locking::AdaptiveMutex<locking::PiMutex> mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ mutex };
+        benchmark::DoNotOptimize(lock);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(adaptive_pi_mutex_lock);
+
+static bool set_fifo_priority(int priority) {
+    sched_param param{ };
+    param.sched_priority = priority;
+
+    return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+}
+
+static void spin_for(std::chrono::steady_clock::duration duration) {
+    const auto end = std::chrono::steady_clock::now() + duration;
+
+    while (std::chrono::steady_clock::now() < end) { }
+}
+
+// low, medium and high priority threads share one CPU; low holds the lock that
+// high wants while medium spins. without priority inheritance, high waits for
+// medium to finish, so the reported time is high's wait for the lock
+template <typename M>
+static void priority_inversion(benchmark::State &state) {
+    using namespace std::chrono_literals;
+
+    int policy;
+    sched_param param;
+    pthread_getschedparam(pthread_self(), &policy, &param);
+
+    cpu_set_t cpus;
+    sched_getaffinity(0, sizeof(cpus), &cpus);
+
+    cpu_set_t cpu;
+    CPU_ZERO(&cpu);
+    CPU_SET(sched_getcpu(), &cpu);
+
+    if (sched_setaffinity(0, sizeof(cpu), &cpu) != 0 || !set_fifo_priority(40)) {
+        sched_setaffinity(0, sizeof(cpus), &cpus);
+        state.SkipWithError("SCHED_FIFO is unavailable");
+
+        return;
+    }
+
+    for (auto _ : state) {
+        M mutex;
+        std::atomic<bool> is_locked = false;
+        std::chrono::steady_clock::duration waited{ };
+
+        std::thread low{ [&mutex, &is_locked] {
+            set_fifo_priority(10);
+
+            std::scoped_lock lock{ mutex };
+            is_locked = true;
+            spin_for(1ms);
+        } };
+
+        while (!is_locked) {
+            std::this_thread::sleep_for(100us);
+        }
+
+        std::thread high{ [&mutex, &waited] {
+            set_fifo_priority(30);
+
+            const auto start = std::chrono::steady_clock::now();
+            std::scoped_lock lock{ mutex };
+            waited = std::chrono::steady_clock::now() - start;
+        } };
+
+        std::thread medium{ [] {
+            set_fifo_priority(20);
+            spin_for(20ms);
+        } };
+
+        low.join();
+        high.join();
+        medium.join();
+
+        state.SetIterationTime(
+            std::chrono::duration<double>{ waited }.count());
+    }
+
+    pthread_setschedparam(pthread_self(), policy, &param);
+    sched_setaffinity(0, sizeof(cpus), &cpus);
+}
+BENCHMARK_TEMPLATE(priority_inversion, locking::PiMutex)
+    ->Iterations(8)->UseManualTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(priority_inversion, std::mutex)
+    ->Iterations(8)->UseManualTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,100 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstddef>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include <locking/rcu.hpp>
+
+#include <benchmark/benchmark.h>
+
+static void rcu_read_lock(benchmark::State &state) {
+    locking::Rcu<> rcu;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ rcu };
+        benchmark::DoNotOptimize(lock);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(rcu_read_lock);
+
+static void rcu_synchronize(benchmark::State &state) {
+    locking::Rcu<> rcu;
+
+    for (auto _ : state) {
+        rcu.synchronize();
+    }
+}
+BENCHMARK(rcu_synchronize);
+
+// every thread reads a table; thread 0 also replaces it every 64 reads
+static void rcu_read_mostly(benchmark::State &state) {
+    using Table = std::array<int, 64>;
+
+    static locking::Rcu<> rcu;
+    static std::atomic<Table*> table = nullptr;
+
+    if (state.thread_index() == 0) {
+        table = new Table{ };
+    }
+
+    std::size_t i = 0;
+
+    for (auto _ : state) {
+        ++i;
+
+        {
+            [[maybe_unused]] std::scoped_lock lock{ rcu };
+            const auto current = table.load(std::memory_order_acquire);
+            benchmark::DoNotOptimize((*current)[i % 64]);
+        }
+
+        if (state.thread_index() == 0 && i % 64 == 0) {
+            std::scoped_lock lock{ rcu.writer() };
+            const auto next = new Table{ *table.load() };
+            ++(*next)[i / 64 % 64];
+            rcu.retire(table.exchange(next, std::memory_order_acq_rel));
+        }
+    }
+
+    if (state.thread_index() == 0) {
+        rcu.synchronize();
+        delete table.exchange(nullptr);
+    }
+}
+BENCHMARK(rcu_read_mostly)
+    ->ThreadRange(1, static_cast<int>(std::thread::hardware_concurrency()) * 4)
+    ->UseRealTime();
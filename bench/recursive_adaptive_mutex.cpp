@@ -0,0 +1,68 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <mutex>
+
+#include <locking/recursive_adaptive_mutex.hpp>
+
+#include <benchmark/benchmark.h>
+
+static void recursive_adaptive_mutex_default_ctor(benchmark::State &state) {
+    for (auto _ : state) {
+        [[maybe_unused]] locking::RecursiveAdaptiveMutex<> mutex;
+        benchmark::DoNotOptimize(mutex);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(recursive_adaptive_mutex_default_ctor);
+
+static void recursive_adaptive_mutex_lock(benchmark::State &state) {
+    locking::RecursiveAdaptiveMutex<> mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ mutex };
+        benchmark::DoNotOptimize(lock);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(recursive_adaptive_mutex_lock);
+
+static void recursive_adaptive_mutex_nested_lock(benchmark::State &state) {
+    locking::RecursiveAdaptiveMutex<> mutex;
+    [[maybe_unused]] std::scoped_lock outer{ mutex };
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ mutex };
+        benchmark::DoNotOptimize(lock);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(recursive_adaptive_mutex_nested_lock);
@@ -30,6 +30,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 #include <mutex>
+#include <thread>
 
 #include <locking/spinlock.hpp>
 
@@ -54,3 +55,44 @@ static void spinlock_lock(benchmark::State &state) {
     }
 }
 BENCHMARK(spinlock_lock);
+
+static void spinlock_oversubscribed_lock(benchmark::State &state) {
+    static locking::Spinlock mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ mutex };
+
+        for (int i = 0; i < 64; ++i) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+}
+BENCHMARK(spinlock_oversubscribed_lock)
+    ->Threads(static_cast<int>(std::thread::hardware_concurrency()) * 4)
+    ->UseRealTime();
+
+static void owner_aware_spinlock_lock(benchmark::State &state) {
+    locking::OwnerAwareSpinlock spinlock;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ spinlock };
+        benchmark::DoNotOptimize(lock);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(owner_aware_spinlock_lock);
+
+static void owner_aware_spinlock_oversubscribed_lock(benchmark::State &state) {
+    static locking::OwnerAwareSpinlock mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::scoped_lock lock{ mutex };
+
+        for (int i = 0; i < 64; ++i) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+}
+BENCHMARK(owner_aware_spinlock_oversubscribed_lock)
+    ->Threads(static_cast<int>(std::thread::hardware_concurrency()) * 4)
+    ->UseRealTime();
@@ -0,0 +1,168 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <locking/upgradeable_shared_mutex.hpp>
+
+#include <benchmark/benchmark.h>
+
+static void upgradeable_shared_mutex_default_ctor(benchmark::State &state) {
+    for (auto _ : state) {
+        [[maybe_unused]] locking::UpgradeableSharedMutex<> mutex;
+        benchmark::DoNotOptimize(mutex);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(upgradeable_shared_mutex_default_ctor);
+
+static void upgradeable_shared_mutex_lock(benchmark::State &state) {
+    locking::UpgradeableSharedMutex<> mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::unique_lock lock{ mutex };
+        benchmark::DoNotOptimize(lock);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(upgradeable_shared_mutex_lock);
+
+static void upgradeable_shared_mutex_lock_shared(benchmark::State &state) {
+    locking::UpgradeableSharedMutex<> mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] std::shared_lock lock{ mutex };
+        benchmark::DoNotOptimize(lock);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(upgradeable_shared_mutex_lock_shared);
+
+static void upgradeable_shared_mutex_lock_upgrade(benchmark::State &state) {
+    locking::UpgradeableSharedMutex<> mutex;
+
+    for (auto _ : state) {
+        [[maybe_unused]] locking::UpgradeLock lock{ mutex };
+        benchmark::DoNotOptimize(lock);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(upgradeable_shared_mutex_lock_upgrade);
+
+static std::uint32_t next_key(std::uint32_t &seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    return seed % 8192;
+}
+
+static std::uint32_t fill(std::uint32_t key) {
+    for (int i = 0; i < 256; ++i) {
+        benchmark::DoNotOptimize(key);
+    }
+
+    return key;
+}
+
+// misses compute the value under an upgradeable lock, which readers can share,
+// and only upgrade to insert it
+static void upgradeable_shared_mutex_lookup_or_insert(benchmark::State &state) {
+    static locking::UpgradeableSharedMutex<> mutex;
+    static std::unordered_map<std::uint32_t, std::uint32_t> cache;
+
+    auto seed = static_cast<std::uint32_t>(state.thread_index()) + 1;
+
+    for (auto _ : state) {
+        const auto key = next_key(seed);
+
+        {
+            std::shared_lock lock{ mutex };
+            const auto found = cache.find(key);
+
+            if (found != cache.end()) {
+                benchmark::DoNotOptimize(found->second);
+
+                continue;
+            }
+        }
+
+        locking::UpgradeLock lock{ mutex };
+
+        if (cache.find(key) != cache.end()) {
+            continue;
+        }
+
+        const auto value = fill(key);
+        [[maybe_unused]] const auto exclusive = lock.upgrade();
+
+        if (cache.size() >= 4096) {
+            cache.clear();
+        }
+
+        cache.emplace(key, value);
+    }
+}
+BENCHMARK(upgradeable_shared_mutex_lookup_or_insert)
+    ->ThreadRange(1, static_cast<int>(std::thread::hardware_concurrency()) * 4)
+    ->UseRealTime();
+
+// every thread reads a table; thread 0 also updates it every 64 reads
+static void upgradeable_shared_mutex_read_mostly(benchmark::State &state) {
+    static locking::UpgradeableSharedMutex<> mutex;
+    static std::array<int, 64> table{ };
+
+    std::size_t i = 0;
+
+    for (auto _ : state) {
+        ++i;
+
+        {
+            std::shared_lock lock{ mutex };
+            benchmark::DoNotOptimize(table[i % 64]);
+        }
+
+        if (state.thread_index() == 0 && i % 64 == 0) {
+            std::unique_lock lock{ mutex };
+            ++table[i / 64 % 64];
+        }
+    }
+}
+BENCHMARK(upgradeable_shared_mutex_read_mostly)
+    ->ThreadRange(1, static_cast<int>(std::thread::hardware_concurrency()) * 4)
+    ->UseRealTime();
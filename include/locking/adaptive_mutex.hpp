@@ -32,25 +32,86 @@
 #ifndef LOCKING_HYBRID_MUTEX_HPP
 #define LOCKING_HYBRID_MUTEX_HPP
 
+#include <locking/detail/handoff_queue.hpp>
+#include <locking/detail/predictor.hpp>
+#include <locking/detail/thread_state.hpp>
 #include <locking/type_traits.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <mutex>
+#include <type_traits>
 
 namespace locking {
 
-template <typename M = std::mutex, typename C = std::chrono::steady_clock>
+// blocked waiters compete with spinning arrivals for the lock
+struct BargingPolicy { };
+
+// like sync.Mutex in Go: once a blocked waiter has waited for much longer than
+// the predicted spin, the lock goes to blocked waiters in arrival order until
+// none are left
+struct StarvationPolicy { };
+
+template <
+    typename M = std::mutex,
+    typename C = std::chrono::steady_clock,
+    typename P = BargingPolicy
+>
 class AdaptiveMutex {
 private:
     using RepT = typename C::rep;
 
+    static constexpr bool IS_STARVATION_AWARE =
+        std::is_same_v<P, StarvationPolicy>;
+
     M mutex_{ };
     std::atomic<RepT> predictor_ = 0;
+    std::atomic<detail::ThreadState*> owner_ = nullptr;
+    std::conditional_t<
+        IS_STARVATION_AWARE,
+        detail::HandoffQueue<C>,
+        detail::NoHandoffQueue
+    > queue_{ };
+
+    void set_owner() {
+        auto &self = detail::ThreadState::current();
+        self.set_running();
+        owner_.store(&self, std::memory_order_relaxed);
+    }
+
+    bool is_reserved() const noexcept {
+        if constexpr (IS_STARVATION_AWARE) {
+            return queue_.is_starving();
+        } else {
+            return false;
+        }
+    }
+
+    // the starvation threshold is 64 predicted spins, but at least 1ms
+    void block(typename C::time_point start) {
+        if constexpr (IS_STARVATION_AWARE) {
+            const RepT predicted =
+                std::min(predictor_.load(), detail::max_prediction<C>());
+            const auto threshold = std::max(
+                typename C::duration{ 64 * predicted },
+                std::chrono::duration_cast<typename C::duration>(
+                    std::chrono::milliseconds{ 1 }
+                )
+            );
+
+            queue_.lock(mutex_, start, threshold);
+        } else {
+            mutex_.lock();
+        }
+    }
 
 public:
     static_assert(IS_MUTEX<M>, "L must be a Mutex type");
     static_assert(IS_CLOCK<C>, "C must be a Clock type");
+    static_assert(std::is_same_v<P, BargingPolicy>
+                  || std::is_same_v<P, StarvationPolicy>,
+                  "P must be BargingPolicy or StarvationPolicy");
 
     AdaptiveMutex() = default;
 
@@ -66,25 +127,50 @@ public:
         const auto start = C::now();
         RepT measured = 0;
 
-        while (!mutex_.try_lock()) {
+        while (is_reserved() || !mutex_.try_lock()) {
             const auto now = C::now();
             measured = (now - start).count();
 
-            if (measured >= 2 * predictor_) {
-                mutex_.lock();
+            // an owner that is off-CPU will not release the lock while we spin,
+            // and its hold time says nothing about the predictor
+            const auto owner = owner_.load(std::memory_order_relaxed);
+            const bool is_owner_running = !owner || owner->is_running();
+
+            if (measured >= 2 * predictor_ || !is_owner_running
+                || is_reserved()) {
+                detail::ThreadState::current().set_blocked();
+                block(start);
+                set_owner();
+
+                if (is_owner_running) {
+                    predictor_ += (measured - predictor_) / 8;
+                }
 
-                break;
+                return;
             }
         }
 
+        set_owner();
         predictor_ += (measured - predictor_) / 8;
     }
 
     bool try_lock() {
-        return mutex_.try_lock();
+        if (is_reserved() || !mutex_.try_lock()) {
+            return false;
+        }
+
+        set_owner();
+
+        return true;
     }
 
     void unlock() {
+        owner_.store(nullptr, std::memory_order_relaxed);
+
+        if constexpr (IS_STARVATION_AWARE) {
+            queue_.update();
+        }
+
         mutex_.unlock();
     }
 };
@@ -0,0 +1,223 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_BARRIER_HPP
+#define LOCKING_BARRIER_HPP
+
+#include <locking/detail/barrier_phase.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace locking {
+
+struct EmptyCompletion {
+    void operator()() const noexcept { }
+};
+
+template <typename F = EmptyCompletion, typename C = std::chrono::steady_clock>
+class Barrier {
+private:
+    std::atomic<std::uint32_t> arrived_ = 0;
+    std::uint32_t expected_;
+    detail::BarrierPhase<F, C> phase_;
+
+public:
+    using ArrivalToken = std::uint32_t;
+
+    // a barrier that expects no one can never complete a phase
+    explicit Barrier(std::ptrdiff_t expected, F completion = F{ })
+    : expected_{ static_cast<std::uint32_t>(expected) },
+      phase_{ std::move(completion) } {
+        assert(expected > 0);
+    }
+
+    Barrier(const Barrier &other) = delete;
+
+    Barrier(Barrier &&other) = delete;
+
+    Barrier& operator=(const Barrier &other) = delete;
+
+    Barrier& operator=(Barrier &&other) = delete;
+
+    static constexpr std::ptrdiff_t max() noexcept {
+        return std::numeric_limits<std::int32_t>::max();
+    }
+
+    [[nodiscard]] ArrivalToken arrive() {
+        const auto phase = phase_.current();
+
+        if (arrived_.fetch_add(1, std::memory_order_acq_rel) + 1 == expected_) {
+            arrived_.store(0, std::memory_order_relaxed);
+            phase_.complete();
+        }
+
+        return phase;
+    }
+
+    void wait(ArrivalToken phase) {
+        phase_.wait(phase);
+    }
+
+    void arrive_and_wait() {
+        wait(arrive());
+    }
+};
+
+// arrivals are combined in a tree of counters with at most fan_in arrivals
+// each, so no single cache line takes an RMW from every participant.
+// participants identify themselves with a distinct index in [0, expected)
+template <typename F = EmptyCompletion, typename C = std::chrono::steady_clock>
+class CombiningBarrier {
+private:
+    static constexpr std::size_t ROOT = std::numeric_limits<std::size_t>::max();
+
+    struct alignas(64) Node {
+        std::atomic<std::uint32_t> arrived = 0;
+        std::uint32_t expected = 0;
+        std::size_t parent = ROOT;
+    };
+
+    std::size_t fan_in_;
+    std::unique_ptr<Node[]> nodes_;
+    detail::BarrierPhase<F, C> phase_;
+
+    // every level has at least one node, so the tree always has a root
+    static std::size_t level_width(std::size_t children,
+                                   std::size_t fan_in) noexcept {
+        return std::max<std::size_t>((children + fan_in - 1) / fan_in, 1);
+    }
+
+    static std::size_t count_nodes(std::size_t children, std::size_t fan_in) {
+        std::size_t count = 0;
+
+        do {
+            children = level_width(children, fan_in);
+            count += children;
+        } while (children > 1);
+
+        return count;
+    }
+
+public:
+    using ArrivalToken = std::uint32_t;
+
+    explicit CombiningBarrier(std::ptrdiff_t expected, F completion = F{ },
+                              std::size_t fan_in = 4)
+    : fan_in_{ std::max<std::size_t>(fan_in, 2) },
+      nodes_{ new Node[count_nodes(static_cast<std::size_t>(expected), fan_in_)] },
+      phase_{ std::move(completion) } {
+        assert(expected > 0);
+
+        auto children = static_cast<std::size_t>(expected);
+        std::size_t level = 0;
+
+        for (;;) {
+            const auto width = level_width(children, fan_in_);
+
+            for (std::size_t i = 0; i < width; ++i) {
+                nodes_[level + i].expected = static_cast<std::uint32_t>(
+                    std::min(fan_in_, children - i * fan_in_)
+                );
+            }
+
+            if (width == 1) {
+                break;
+            }
+
+            for (std::size_t i = 0; i < width; ++i) {
+                nodes_[level + i].parent = level + width + i / fan_in_;
+            }
+
+            children = width;
+            level += width;
+        }
+    }
+
+    CombiningBarrier(const CombiningBarrier &other) = delete;
+
+    CombiningBarrier(CombiningBarrier &&other) = delete;
+
+    CombiningBarrier& operator=(const CombiningBarrier &other) = delete;
+
+    CombiningBarrier& operator=(CombiningBarrier &&other) = delete;
+
+    static constexpr std::ptrdiff_t max() noexcept {
+        return std::numeric_limits<std::int32_t>::max();
+    }
+
+    // the last arrival at a node resets it before carrying on to the parent;
+    // no one can arrive at it again until the phase completes
+    [[nodiscard]] ArrivalToken arrive(std::size_t participant) {
+        const auto phase = phase_.current();
+
+        for (auto index = participant / fan_in_;;) {
+            auto &node = nodes_[index];
+
+            if (node.arrived.fetch_add(1, std::memory_order_acq_rel) + 1
+                != node.expected) {
+                break;
+            }
+
+            node.arrived.store(0, std::memory_order_relaxed);
+
+            if (node.parent == ROOT) {
+                phase_.complete();
+
+                break;
+            }
+
+            index = node.parent;
+        }
+
+        return phase;
+    }
+
+    void wait(ArrivalToken phase) {
+        phase_.wait(phase);
+    }
+
+    void arrive_and_wait(std::size_t participant) {
+        wait(arrive(participant));
+    }
+};
+
+} // namespace locking
+
+#endif
@@ -0,0 +1,220 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_BIASED_LOCK_HPP
+#define LOCKING_BIASED_LOCK_HPP
+
+#include <locking/detail/membarrier.hpp>
+#include <locking/type_traits.hpp>
+
+#include <cstdint>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace locking {
+
+// the first thread to lock owns the bias and locks and unlocks with plain
+// stores to is_biased_held_. any other thread revokes the bias for a single
+// acquisition: it takes M, raises is_revoke_requested_, issues the heavy half
+// of an asymmetric fence that pairs with the owner's light half, then waits for
+// the owner to leave its critical section. it drops the request when it
+// unlocks; until then the owner goes through M like everyone else.
+//
+// the heavy fence is a syscall, so the bias only pays while the owner takes
+// the lock far more often than everyone else. every REVOCATION_WINDOW
+// revocations, the revoker counts how often the owner used its fast path in the
+// meantime. if that was less than MIN_OWNER_SHARE times per revocation, the
+// owner has gone quiet, exited, or shares the lock too evenly, and the bias is
+// disabled for good: the request stays raised and everyone uses M unfenced. the
+// bias is never handed to another thread, since a stale owner could then race
+// the new one on is_biased_held_
+template <typename M = std::mutex>
+class BiasedLock {
+private:
+    static constexpr std::uint64_t REVOCATION_WINDOW = 16;
+    static constexpr std::uint64_t MIN_OWNER_SHARE = 16;
+
+    std::atomic<std::thread::id> owner_{ };
+    std::atomic<bool> is_biased_held_ = false;
+    std::atomic<bool> is_revoke_requested_ = false;
+
+    // written only by whoever holds the lock
+    std::uint64_t owner_acquisitions_ = 0;
+    std::uint64_t revocations_ = 0;
+    bool is_disabled_ = false;
+
+    M mutex_{ };
+
+    bool try_lock_biased() noexcept {
+        if (is_revoke_requested_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+
+        const auto self = std::this_thread::get_id();
+        auto owner = owner_.load(std::memory_order_relaxed);
+
+        if (owner != self
+            && (owner != std::thread::id{ }
+                || !owner_.compare_exchange_strong(owner, self))) {
+            return false;
+        }
+
+        is_biased_held_.store(true, std::memory_order_relaxed);
+        detail::light_fence();
+
+        if (is_revoke_requested_.load(std::memory_order_acquire)) {
+            is_biased_held_.store(false, std::memory_order_release);
+
+            return false;
+        }
+
+        ++owner_acquisitions_;
+
+        return true;
+    }
+
+    // to be called with mutex_ held. the bias owner already knows it is not
+    // inside its own critical section, and a disabled bias has no owner to
+    // fence against
+    bool needs_revoke() const noexcept {
+        return !is_disabled_
+               && owner_.load(std::memory_order_relaxed)
+                  != std::this_thread::get_id();
+    }
+
+    void request_revoke() noexcept {
+        is_revoke_requested_.store(true, std::memory_order_relaxed);
+        detail::heavy_fence();
+    }
+
+    // to be called with the bias revoked and mutex_ held
+    void count_revocation() noexcept {
+        if (++revocations_ < REVOCATION_WINDOW) {
+            return;
+        }
+
+        if (owner_acquisitions_ < REVOCATION_WINDOW * MIN_OWNER_SHARE) {
+            is_disabled_ = true;
+        }
+
+        owner_acquisitions_ = 0;
+        revocations_ = 0;
+    }
+
+    void release_mutex() {
+        if (!is_disabled_) {
+            is_revoke_requested_.store(false, std::memory_order_release);
+        }
+
+        mutex_.unlock();
+    }
+
+    bool is_biased_held() const noexcept {
+        return is_biased_held_.load(std::memory_order_acquire);
+    }
+
+public:
+    static_assert(IS_MUTEX<M>, "M must be a Mutex type");
+
+    BiasedLock() = default;
+
+    BiasedLock(const BiasedLock &other) = delete;
+
+    BiasedLock(BiasedLock &&other) = delete;
+
+    BiasedLock& operator=(const BiasedLock &other) = delete;
+
+    BiasedLock& operator=(BiasedLock &&other) = delete;
+
+    void lock() {
+        if (try_lock_biased()) {
+            return;
+        }
+
+        mutex_.lock();
+
+        if (!needs_revoke()) {
+            return;
+        }
+
+        request_revoke();
+
+        while (is_biased_held()) {
+            std::this_thread::yield();
+        }
+
+        count_revocation();
+    }
+
+    bool try_lock() {
+        if (try_lock_biased()) {
+            return true;
+        }
+
+        if (!mutex_.try_lock()) {
+            return false;
+        }
+
+        if (!needs_revoke()) {
+            return true;
+        }
+
+        request_revoke();
+
+        if (is_biased_held()) {
+            release_mutex();
+
+            return false;
+        }
+
+        count_revocation();
+
+        return true;
+    }
+
+    void unlock() {
+        if (is_biased_held_.load(std::memory_order_relaxed)
+            && owner_.load(std::memory_order_relaxed)
+               == std::this_thread::get_id()) {
+            is_biased_held_.store(false, std::memory_order_release);
+
+            return;
+        }
+
+        release_mutex();
+    }
+};
+
+} // namespace locking
+
+#endif
@@ -0,0 +1,146 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_COUNTING_SEMAPHORE_HPP
+#define LOCKING_COUNTING_SEMAPHORE_HPP
+
+#include <locking/detail/futex.hpp>
+#include <locking/detail/predictor.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+namespace locking {
+
+template <
+    std::ptrdiff_t LeastMaxValue = std::numeric_limits<std::int32_t>::max(),
+    typename C = std::chrono::steady_clock
+>
+class CountingSemaphore {
+private:
+    // parked waiters set this bit in count_, so that release() learns whether
+    // to wake anyone from the same RMW that publishes the count. it must not
+    // touch the semaphore after that: an acquirer may already have destroyed it
+    static constexpr std::uint32_t WAITERS = std::uint32_t{ 1 } << 31;
+
+    std::atomic<std::uint32_t> count_;
+    detail::Predictor<C> predictor_{ };
+
+    void park() noexcept {
+        auto count = count_.load(std::memory_order_relaxed);
+
+        if (count == 0
+            && !count_.compare_exchange_strong(count, WAITERS,
+                                               std::memory_order_relaxed)) {
+            return;
+        }
+
+        if ((count & ~WAITERS) == 0) {
+            detail::futex_wait(count_, WAITERS);
+        }
+    }
+
+    // a woken waiter cannot tell whether it was the last one, so it takes the
+    // count with WAITERS set and leaves the next release to find out
+    bool try_acquire(std::uint32_t waiters) noexcept {
+        auto count = count_.load(std::memory_order_relaxed);
+
+        while ((count & ~WAITERS) > 0) {
+            if (count_.compare_exchange_weak(count, (count - 1) | waiters,
+                                             std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+public:
+    static_assert(LeastMaxValue >= 0, "LeastMaxValue must be non-negative");
+    static_assert(LeastMaxValue <= std::numeric_limits<std::int32_t>::max(),
+                  "LeastMaxValue must fit in a futex word");
+
+    explicit CountingSemaphore(std::ptrdiff_t desired) noexcept
+    : count_{ static_cast<std::uint32_t>(desired) } { }
+
+    CountingSemaphore(const CountingSemaphore &other) = delete;
+
+    CountingSemaphore(CountingSemaphore &&other) = delete;
+
+    CountingSemaphore& operator=(const CountingSemaphore &other) = delete;
+
+    CountingSemaphore& operator=(CountingSemaphore &&other) = delete;
+
+    static constexpr std::ptrdiff_t max() noexcept {
+        return LeastMaxValue;
+    }
+
+    void release(std::ptrdiff_t update = 1) noexcept {
+        auto count = count_.load(std::memory_order_relaxed);
+
+        while (!count_.compare_exchange_weak(
+            count, (count & ~WAITERS) + static_cast<std::uint32_t>(update),
+            std::memory_order_release, std::memory_order_relaxed
+        )) { }
+
+        if (count & WAITERS) {
+            detail::futex_wake(count_, static_cast<int>(
+                std::min<std::ptrdiff_t>(update, std::numeric_limits<int>::max())
+            ));
+        }
+    }
+
+    void acquire() {
+        std::uint32_t waiters = 0;
+
+        predictor_.wait([this, &waiters] { return try_acquire(waiters); },
+                        [this, &waiters] {
+                            park();
+                            waiters = WAITERS;
+                        });
+    }
+
+    bool try_acquire() noexcept {
+        return try_acquire(0);
+    }
+};
+
+using BinarySemaphore = CountingSemaphore<1>;
+
+} // namespace locking
+
+#endif
@@ -0,0 +1,102 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_DETAIL_BARRIER_PHASE_HPP
+#define LOCKING_DETAIL_BARRIER_PHASE_HPP
+
+#include <locking/detail/futex.hpp>
+#include <locking/detail/predictor.hpp>
+
+#include <cstdint>
+
+#include <atomic>
+#include <utility>
+
+namespace locking::detail {
+
+// the phase counter that barrier participants wait on; whoever completes a
+// phase runs the completion function before releasing the others. parked
+// waiters set the top bit, so complete() learns whether to wake anyone from
+// the RMW that releases them and never reads the barrier afterwards
+template <typename F, typename C>
+class BarrierPhase {
+private:
+    static constexpr std::uint32_t WAITERS = std::uint32_t{ 1 } << 31;
+
+    std::atomic<std::uint32_t> phase_ = 0;
+    F completion_;
+    Predictor<C> predictor_{ };
+
+    void park(std::uint32_t phase) noexcept {
+        auto current = phase_.load(std::memory_order_relaxed);
+
+        if (current == phase
+            && !phase_.compare_exchange_strong(current, phase | WAITERS,
+                                               std::memory_order_relaxed)) {
+            return;
+        }
+
+        if ((current & ~WAITERS) == phase) {
+            futex_wait(phase_, phase | WAITERS);
+        }
+    }
+
+public:
+    explicit BarrierPhase(F completion) : completion_{ std::move(completion) } { }
+
+    std::uint32_t current() const noexcept {
+        return phase_.load(std::memory_order_acquire) & ~WAITERS;
+    }
+
+    void complete() {
+        completion_();
+
+        auto phase = phase_.load(std::memory_order_relaxed);
+
+        while (!phase_.compare_exchange_weak(
+            phase, ((phase & ~WAITERS) + 1) & ~WAITERS,
+            std::memory_order_acq_rel, std::memory_order_relaxed
+        )) { }
+
+        if (phase & WAITERS) {
+            futex_wake(phase_);
+        }
+    }
+
+    void wait(std::uint32_t phase) {
+        predictor_.wait([this, phase] { return current() != phase; },
+                        [this, phase] { park(phase); });
+    }
+};
+
+} // namespace locking::detail
+
+#endif
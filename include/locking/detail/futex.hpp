@@ -0,0 +1,88 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_DETAIL_FUTEX_HPP
+#define LOCKING_DETAIL_FUTEX_HPP
+
+#include <cstdint>
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace locking::detail {
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+              "std::atomic<std::uint32_t> must be usable as a futex word");
+
+inline long futex(const std::atomic<std::uint32_t> &word, int op,
+                  std::uint32_t val, const void *timeout = nullptr) noexcept {
+    return syscall(SYS_futex, reinterpret_cast<const std::uint32_t*>(&word), op,
+                   val, timeout, nullptr, 0);
+}
+
+inline void futex_wait(const std::atomic<std::uint32_t> &word,
+                       std::uint32_t expected) noexcept {
+    futex(word, FUTEX_WAIT_PRIVATE, expected);
+}
+
+template <typename R, typename P>
+void futex_wait_for(const std::atomic<std::uint32_t> &word,
+                    std::uint32_t expected,
+                    std::chrono::duration<R, P> timeout) noexcept {
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout);
+    timespec relative{ };
+    relative.tv_sec = static_cast<time_t>(ns.count() / 1'000'000'000);
+    relative.tv_nsec = static_cast<long>(ns.count() % 1'000'000'000);
+
+    futex(word, FUTEX_WAIT_PRIVATE, expected, &relative);
+}
+
+inline void futex_wake(std::atomic<std::uint32_t> &word,
+                       int count = std::numeric_limits<int>::max()) noexcept {
+    futex(word, FUTEX_WAKE_PRIVATE, static_cast<std::uint32_t>(count));
+}
+
+inline std::uint32_t this_thread_tid() noexcept {
+    thread_local const auto tid =
+        static_cast<std::uint32_t>(syscall(SYS_gettid));
+
+    return tid;
+}
+
+} // namespace locking::detail
+
+#endif
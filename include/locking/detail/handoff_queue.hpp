@@ -0,0 +1,146 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_DETAIL_HANDOFF_QUEUE_HPP
+#define LOCKING_DETAIL_HANDOFF_QUEUE_HPP
+
+#include <locking/detail/futex.hpp>
+
+#include <cstdint>
+
+#include <atomic>
+#include <limits>
+
+namespace locking::detail {
+
+// blocked waiters queue up in arrival order, each parked on its own node so
+// that passing the head on wakes exactly one thread; only the waiter at the
+// head blocks in the underlying mutex, so a PiMutex lends it priority. the head
+// publishes when it will have waited past the threshold, and the owner checks
+// that before unlocking: past it, the queue is starving and the lock is
+// reserved for the head, so everyone else joins the queue instead of spinning
+// or barging. the mutex is still unlocked by the thread that locked it, so any
+// Mutex type works, and nothing touches the queue once it is unlocked
+template <typename C>
+class HandoffQueue {
+private:
+    using RepT = typename C::rep;
+
+    static constexpr RepT NO_DEADLINE = std::numeric_limits<RepT>::max();
+
+    struct Node {
+        std::atomic<Node*> next = nullptr;
+        std::atomic<std::uint32_t> is_head = 0;
+    };
+
+    std::atomic<Node*> tail_ = nullptr;
+    std::atomic<RepT> deadline_ = NO_DEADLINE;
+    std::atomic<bool> is_starving_ = false;
+
+    void enqueue(Node &node) noexcept {
+        const auto prev = tail_.exchange(&node);
+
+        if (!prev) {
+            return;
+        }
+
+        prev->next.store(&node, std::memory_order_release);
+
+        while (!node.is_head.load(std::memory_order_acquire)) {
+            futex_wait(node.is_head, 0);
+        }
+    }
+
+    // false if node was the last one in the queue
+    bool dequeue(Node &node) noexcept {
+        auto next = node.next.load(std::memory_order_acquire);
+
+        if (!next) {
+            auto expected = &node;
+
+            if (tail_.compare_exchange_strong(expected, nullptr)) {
+                return false;
+            }
+
+            // a successor has swapped itself into tail_ but not linked yet
+            while (!(next = node.next.load(std::memory_order_acquire))) { }
+        }
+
+        next->is_head.store(1, std::memory_order_release);
+        futex_wake(next->is_head, 1);
+
+        return true;
+    }
+
+public:
+    bool is_starving() const noexcept {
+        return is_starving_.load(std::memory_order_relaxed);
+    }
+
+    template <typename M>
+    void lock(M &mutex, typename C::time_point start,
+              typename C::duration threshold) {
+        Node node;
+        enqueue(node);
+
+        deadline_.store((start + threshold).time_since_epoch().count(),
+                        std::memory_order_relaxed);
+        mutex.lock();
+
+        if (C::now() - start < threshold) {
+            is_starving_.store(false, std::memory_order_relaxed);
+        }
+
+        deadline_.store(NO_DEADLINE, std::memory_order_relaxed);
+
+        if (!dequeue(node)) {
+            is_starving_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    // to be called before unlocking, since the mutex may be destroyed as soon
+    // as it is unlocked. only reads the clock while someone is queued
+    void update() noexcept {
+        const auto deadline = deadline_.load(std::memory_order_relaxed);
+
+        if (deadline != NO_DEADLINE
+            && C::now().time_since_epoch().count() >= deadline) {
+            is_starving_.store(true, std::memory_order_relaxed);
+        }
+    }
+};
+
+// stands in for HandoffQueue when starvation mode is disabled
+struct NoHandoffQueue { };
+
+} // namespace locking::detail
+
+#endif
@@ -0,0 +1,110 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_DETAIL_PREDICTOR_HPP
+#define LOCKING_DETAIL_PREDICTOR_HPP
+
+#include <locking/type_traits.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace locking::detail {
+
+template <typename C>
+constexpr typename C::rep max_prediction() noexcept {
+    return std::chrono::duration_cast<typename C::duration>(
+        std::chrono::microseconds{ 50 }
+    ).count();
+}
+
+// the spin-then-park strategy of AdaptiveMutex, for primitives that park on
+// their own futex word instead of an underlying mutex. a wait that ends in a
+// park measures about twice the prediction, so the prediction is capped to
+// keep it from growing without bound. nothing can change while we spin on a
+// uniprocessor, so there we always park
+template <typename C>
+class Predictor {
+private:
+    using RepT = typename C::rep;
+
+    static constexpr RepT MAX_PREDICTION = max_prediction<C>();
+
+    inline static const bool IS_UNIPROCESSOR =
+        std::thread::hardware_concurrency() == 1;
+
+    std::atomic<RepT> predictor_ = 0;
+
+public:
+    static_assert(IS_CLOCK<C>, "C must be a Clock type");
+
+    // an immediate success counts as a zero-length wait without reading the
+    // clock, which can cost more than the acquisition itself
+    template <typename F, typename P>
+    void wait(F &&try_acquire, P &&park) {
+        if (try_acquire()) {
+            const auto predictor = predictor_.load(std::memory_order_relaxed);
+
+            // below 8 the decay rounds to zero; skip the store so that the
+            // uncontended path never writes the shared line
+            if (predictor / 8 != 0) {
+                predictor_.store(predictor - predictor / 8,
+                                 std::memory_order_relaxed);
+            }
+
+            return;
+        }
+
+        const auto start = C::now();
+        RepT measured = 0;
+        bool is_parked = false;
+
+        while (!try_acquire()) {
+            if (!is_parked) {
+                const auto now = C::now();
+                measured = (now - start).count();
+                is_parked = IS_UNIPROCESSOR || measured >= 2 * predictor_;
+            }
+
+            if (is_parked) {
+                park();
+            }
+        }
+
+        predictor_ += (std::min(measured, MAX_PREDICTION) - predictor_) / 8;
+    }
+};
+
+} // namespace locking::detail
+
+#endif
@@ -0,0 +1,111 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_DETAIL_RECURSIVE_HPP
+#define LOCKING_DETAIL_RECURSIVE_HPP
+
+#include <locking/type_traits.hpp>
+
+#include <cstddef>
+
+#include <atomic>
+#include <thread>
+
+namespace locking::detail {
+
+// only the owning thread ever stores its own id into owner_, so a relaxed load
+// that compares equal to the calling thread's id can only mean re-entry
+template <typename M>
+class Recursive {
+private:
+    M mutex_{ };
+    std::atomic<std::thread::id> owner_{ };
+    std::size_t depth_ = 0;
+
+public:
+    static_assert(IS_MUTEX<M>, "M must be a Mutex type");
+
+    Recursive() = default;
+
+    Recursive(const Recursive &other) = delete;
+
+    Recursive(Recursive &&other) = delete;
+
+    Recursive& operator=(const Recursive &other) = delete;
+
+    Recursive& operator=(Recursive &&other) = delete;
+
+    void lock() {
+        const auto self = std::this_thread::get_id();
+
+        if (owner_.load(std::memory_order_relaxed) == self) {
+            ++depth_;
+
+            return;
+        }
+
+        mutex_.lock();
+        owner_.store(self, std::memory_order_relaxed);
+        depth_ = 1;
+    }
+
+    bool try_lock() {
+        const auto self = std::this_thread::get_id();
+
+        if (owner_.load(std::memory_order_relaxed) == self) {
+            ++depth_;
+
+            return true;
+        }
+
+        if (!mutex_.try_lock()) {
+            return false;
+        }
+
+        owner_.store(self, std::memory_order_relaxed);
+        depth_ = 1;
+
+        return true;
+    }
+
+    void unlock() {
+        if (--depth_ > 0) {
+            return;
+        }
+
+        owner_.store(std::thread::id{ }, std::memory_order_relaxed);
+        mutex_.unlock();
+    }
+};
+
+} // namespace locking::detail
+
+#endif
@@ -0,0 +1,169 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_DETAIL_THREAD_STATE_HPP
+#define LOCKING_DETAIL_THREAD_STATE_HPP
+
+#include <cstdint>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include <sched.h>
+
+#if __has_include(<sys/rseq.h>)
+#include <sys/rseq.h>
+#define LOCKING_HAS_RSEQ
+#endif
+
+namespace locking::detail {
+
+// published by each thread so that waiters can tell whether a lock holder is
+// on a CPU. a thread is known to be off-CPU if it is blocked, or if the CPU it
+// is on is the one the caller is running on. where glibc has registered rseq,
+// that CPU is read live from the kernel-maintained rseq area, so it follows the
+// thread as it migrates; otherwise it is the CPU sampled when the thread last
+// took a lock. a thread that was preempted on some other CPU looks as if it is
+// running, so oversubscription is only caught on the CPU that preempted it.
+// states are recycled rather than freed when a thread exits, so a stale pointer
+// held by a waiter still refers to a ThreadState
+class ThreadState {
+private:
+    static constexpr int BLOCKED = -1;
+
+    class Registration {
+    private:
+        inline static std::mutex mutex_{ };
+        inline static ThreadState *free_ = nullptr;
+
+    public:
+        ThreadState *state;
+
+        Registration() {
+            {
+                std::scoped_lock lock{ mutex_ };
+
+                if (free_) {
+                    state = free_;
+                    free_ = free_->next_;
+                } else {
+                    state = new ThreadState;
+                }
+            }
+
+            state->live_cpu_.store(this_rseq_cpu());
+        }
+
+        // the rseq area goes away with the thread, so wait out anyone who is
+        // still reading it through this state
+        ~Registration() {
+            state->set_blocked();
+            state->live_cpu_.store(nullptr);
+
+            while (state->readers_.load() != 0) {
+                std::this_thread::yield();
+            }
+
+            std::scoped_lock lock{ mutex_ };
+            state->next_ = free_;
+            free_ = state;
+        }
+    };
+
+    std::atomic<int> cpu_ = BLOCKED;
+    std::atomic<const volatile std::uint32_t*> live_cpu_ = nullptr;
+    mutable std::atomic<std::uint32_t> readers_ = 0;
+    ThreadState *next_ = nullptr;
+
+    ThreadState() = default;
+
+    static const volatile std::uint32_t* this_rseq_cpu() noexcept {
+#ifdef LOCKING_HAS_RSEQ
+        if (__rseq_size > 0) {
+            const auto area = reinterpret_cast<const rseq*>(
+                static_cast<const char*>(__builtin_thread_pointer())
+                + __rseq_offset
+            );
+
+            return &area->cpu_id;
+        }
+#endif
+
+        return nullptr;
+    }
+
+    int last_cpu() const noexcept {
+        ++readers_;
+        const auto live_cpu = live_cpu_.load();
+        const int cpu = live_cpu ? static_cast<int>(*live_cpu)
+                                 : cpu_.load(std::memory_order_relaxed);
+        --readers_;
+
+        return cpu;
+    }
+
+public:
+    ThreadState(const ThreadState &other) = delete;
+
+    ThreadState(ThreadState &&other) = delete;
+
+    ThreadState& operator=(const ThreadState &other) = delete;
+
+    ThreadState& operator=(ThreadState &&other) = delete;
+
+    static ThreadState& current() {
+        thread_local Registration registration;
+
+        return *registration.state;
+    }
+
+    void set_running() noexcept {
+        cpu_.store(sched_getcpu(), std::memory_order_relaxed);
+    }
+
+    void set_blocked() noexcept {
+        cpu_.store(BLOCKED, std::memory_order_relaxed);
+    }
+
+    // a thread that is on the caller's CPU cannot be running right now
+    bool is_running() const noexcept {
+        if (cpu_.load(std::memory_order_relaxed) == BLOCKED) {
+            return false;
+        }
+
+        return last_cpu() != sched_getcpu();
+    }
+};
+
+} // namespace locking::detail
+
+#endif
@@ -99,6 +99,55 @@ public:
     using Type = decltype(test<T>(nullptr));
 };
 
+template <typename T>
+class IsSharedMutexHelper {
+private:
+    template <
+        typename U,
+        typename = std::enable_if_t<IsMutexHelper<U>::Type::value>,
+        typename = decltype(std::declval<U&>().lock_shared()),
+        typename = std::enable_if_t<std::is_same_v<
+            decltype((std::declval<U&>().try_lock_shared())),
+            bool
+        >>,
+        typename = decltype(std::declval<U&>().unlock_shared())
+    >
+    static std::true_type test(std::nullptr_t);
+
+    template <typename U>
+    static std::false_type test(...);
+
+public:
+    using Type = decltype(test<T>(nullptr));
+};
+
+template <typename T>
+class IsUpgradeableMutexHelper {
+private:
+    template <
+        typename U,
+        typename = std::enable_if_t<IsSharedMutexHelper<U>::Type::value>,
+        typename = decltype(std::declval<U&>().lock_upgrade()),
+        typename = std::enable_if_t<std::is_same_v<
+            decltype((std::declval<U&>().try_lock_upgrade())),
+            bool
+        >>,
+        typename = decltype(std::declval<U&>().unlock_upgrade()),
+        typename = decltype(std::declval<U&>().unlock_upgrade_and_lock()),
+        typename = decltype(std::declval<U&>().unlock_and_lock_upgrade()),
+        typename = decltype(std::declval<U&>().unlock_and_lock_shared()),
+        typename =
+            decltype(std::declval<U&>().unlock_upgrade_and_lock_shared())
+    >
+    static std::true_type test(std::nullptr_t);
+
+    template <typename U>
+    static std::false_type test(...);
+
+public:
+    using Type = decltype(test<T>(nullptr));
+};
+
 template <typename T>
 class IsArithmeticHelper {
 private:
@@ -0,0 +1,115 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_LATCH_HPP
+#define LOCKING_LATCH_HPP
+
+#include <locking/detail/futex.hpp>
+#include <locking/detail/predictor.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+namespace locking {
+
+template <typename C = std::chrono::steady_clock>
+class Latch {
+private:
+    // parked waiters set this bit in count_, so the final count_down() learns
+    // whether to wake anyone from its own RMW and never reads the latch again
+    static constexpr std::uint32_t WAITERS = std::uint32_t{ 1 } << 31;
+
+    mutable std::atomic<std::uint32_t> count_;
+    mutable detail::Predictor<C> predictor_{ };
+
+    void park() const noexcept {
+        auto count = count_.load(std::memory_order_relaxed);
+
+        if ((count & ~WAITERS) == 0) {
+            return;
+        }
+
+        if (!(count & WAITERS)
+            && !count_.compare_exchange_strong(count, count | WAITERS,
+                                               std::memory_order_relaxed)) {
+            return;
+        }
+
+        detail::futex_wait(count_, count | WAITERS);
+    }
+
+public:
+    explicit Latch(std::ptrdiff_t expected) noexcept
+    : count_{ static_cast<std::uint32_t>(expected) } { }
+
+    Latch(const Latch &other) = delete;
+
+    Latch(Latch &&other) = delete;
+
+    Latch& operator=(const Latch &other) = delete;
+
+    Latch& operator=(Latch &&other) = delete;
+
+    static constexpr std::ptrdiff_t max() noexcept {
+        return std::numeric_limits<std::int32_t>::max();
+    }
+
+    void count_down(std::ptrdiff_t update = 1) noexcept {
+        const auto decrement = static_cast<std::uint32_t>(update);
+
+        const auto count = count_.fetch_sub(decrement);
+
+        if ((count & ~WAITERS) == decrement && (count & WAITERS)) {
+            detail::futex_wake(count_);
+        }
+    }
+
+    bool try_wait() const noexcept {
+        return (count_.load(std::memory_order_acquire) & ~WAITERS) == 0;
+    }
+
+    void wait() const {
+        predictor_.wait([this] { return try_wait(); }, [this] { park(); });
+    }
+
+    void arrive_and_wait(std::ptrdiff_t update = 1) {
+        count_down(update);
+        wait();
+    }
+};
+
+} // namespace locking
+
+#endif
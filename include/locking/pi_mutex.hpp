@@ -0,0 +1,96 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_PI_MUTEX_HPP
+#define LOCKING_PI_MUTEX_HPP
+
+#include <locking/detail/futex.hpp>
+
+#include <cerrno>
+#include <cstdint>
+
+#include <atomic>
+#include <system_error>
+
+namespace locking {
+
+// the futex word holds the owner's TID, which is what lets the kernel boost the
+// owner to the priority of the highest waiter once the CAS fast path fails
+class PiMutex {
+private:
+    std::atomic<std::uint32_t> word_ = 0;
+
+public:
+    PiMutex() = default;
+
+    PiMutex(const PiMutex &other) = delete;
+
+    PiMutex(PiMutex &&other) = delete;
+
+    PiMutex& operator=(const PiMutex &other) = delete;
+
+    PiMutex& operator=(PiMutex &&other) = delete;
+
+    void lock() {
+        if (try_lock()) {
+            return;
+        }
+
+        while (detail::futex(word_, FUTEX_LOCK_PI_PRIVATE, 0) != 0) {
+            if (errno != EINTR && errno != EAGAIN) {
+                throw std::system_error{ errno, std::system_category(),
+                                         "FUTEX_LOCK_PI" };
+            }
+        }
+    }
+
+    bool try_lock() noexcept {
+        std::uint32_t expected = 0;
+
+        return word_.compare_exchange_strong(expected, detail::this_thread_tid(),
+                                             std::memory_order_acquire,
+                                             std::memory_order_relaxed);
+    }
+
+    void unlock() noexcept {
+        std::uint32_t expected = detail::this_thread_tid();
+
+        if (!word_.compare_exchange_strong(expected, 0,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+            detail::futex(word_, FUTEX_UNLOCK_PI_PRIVATE, 0);
+        }
+    }
+};
+
+} // namespace locking
+
+#endif
@@ -0,0 +1,257 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_RCU_HPP
+#define LOCKING_RCU_HPP
+
+#include <locking/adaptive_mutex.hpp>
+#include <locking/detail/membarrier.hpp>
+#include <locking/type_traits.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace locking {
+
+// readers only write to a record owned by their thread. writers publish new
+// versions through an atomic pointer, then retire() the old version; it is
+// reclaimed by a later synchronize(), once every reader that could have seen it
+// has left its critical section. lock() and unlock() are the read side, and
+// writers serialize among themselves with writer()
+template <typename M = AdaptiveMutex<>>
+class Rcu {
+private:
+    static constexpr std::uint64_t ACTIVE = 1;
+    static constexpr std::size_t MAX_RETIRED = 64;
+    static constexpr std::size_t CACHED_READERS = 4;
+
+    // one cache line each, so readers never share a line with another thread
+    struct alignas(64) Reader {
+        std::atomic<std::uint64_t> epoch = 0;
+        std::size_t depth = 0;
+        std::thread::id owner;
+        Reader *next = nullptr;
+    };
+
+    struct Retired {
+        void *ptr;
+        void (*deleter)(void*);
+    };
+
+    inline static std::atomic<std::uint64_t> next_id_ = 0;
+
+    const std::uint64_t id_ = ++next_id_;
+    std::atomic<std::uint64_t> epoch_ = 1;
+    std::atomic<Reader*> readers_ = nullptr;
+    std::vector<Retired> retired_;
+    M mutex_{ };
+    M writer_{ };
+
+    // each thread caches its records for the few Rcu instances it used most
+    // recently; ids are never reused, so entries for destroyed instances are
+    // never matched and simply age out
+    Reader& this_reader() {
+        thread_local std::array<
+            std::pair<std::uint64_t, Reader*>,
+            CACHED_READERS
+        > cache{ };
+
+        if (cache[0].first == id_) {
+            return *cache[0].second;
+        }
+
+        std::size_t i = 1;
+
+        while (i < CACHED_READERS - 1 && cache[i].first != id_) {
+            ++i;
+        }
+
+        auto entry = (cache[i].first == id_)
+                     ? cache[i]
+                     : std::pair{ id_, &find_reader() };
+
+        std::move_backward(cache.begin(), cache.begin() + i,
+                           cache.begin() + i + 1);
+        cache[0] = entry;
+
+        return *entry.second;
+    }
+
+    // the registry is push-only and searched without a lock, since a thread may
+    // need its record while synchronize() waits for it. a record left behind by
+    // an exited thread is reused by the next thread that is given the same id
+    Reader& find_reader() {
+        const auto self = std::this_thread::get_id();
+        auto head = readers_.load(std::memory_order_acquire);
+
+        for (auto reader = head; reader; reader = reader->next) {
+            if (reader->owner == self) {
+                return *reader;
+            }
+        }
+
+        auto reader = new Reader;
+        reader->owner = self;
+        reader->next = head;
+
+        while (!readers_.compare_exchange_weak(reader->next, reader)) { }
+
+        return *reader;
+    }
+
+    static void reclaim(std::vector<Retired> &retired) noexcept {
+        for (const auto &r : retired) {
+            r.deleter(r.ptr);
+        }
+
+        retired.clear();
+    }
+
+public:
+    static_assert(IS_MUTEX<M>, "M must be a Mutex type");
+
+    Rcu() = default;
+
+    Rcu(const Rcu &other) = delete;
+
+    Rcu(Rcu &&other) = delete;
+
+    Rcu& operator=(const Rcu &other) = delete;
+
+    Rcu& operator=(Rcu &&other) = delete;
+
+    ~Rcu() {
+        reclaim(retired_);
+
+        for (auto reader = readers_.load(); reader;) {
+            delete std::exchange(reader, reader->next);
+        }
+    }
+
+    void read_lock() {
+        auto &reader = this_reader();
+
+        if (reader.depth++ == 0) {
+            const auto epoch = epoch_.load(std::memory_order_acquire);
+            reader.epoch.store(epoch << 1 | ACTIVE, std::memory_order_relaxed);
+            detail::light_fence();
+        }
+    }
+
+    void read_unlock() {
+        auto &reader = this_reader();
+
+        if (--reader.depth == 0) {
+            detail::light_fence();
+            reader.epoch.store(0, std::memory_order_release);
+        }
+    }
+
+    void lock() {
+        read_lock();
+    }
+
+    void unlock() {
+        read_unlock();
+    }
+
+    M& writer() noexcept {
+        return writer_;
+    }
+
+    // waits for every reader that entered before the call and reclaims what was
+    // retired before it. must not be called from a read-side critical section
+    void synchronize() {
+        assert(this_reader().depth == 0);
+
+        std::vector<Retired> retired;
+
+        {
+            std::scoped_lock lock{ mutex_ };
+            const auto epoch = epoch_.fetch_add(1) + 1;
+            detail::heavy_fence();
+
+            for (auto reader = readers_.load(std::memory_order_acquire); reader;
+                 reader = reader->next) {
+                for (;;) {
+                    const auto current =
+                        reader->epoch.load(std::memory_order_acquire);
+
+                    if (!(current & ACTIVE) || current >> 1 >= epoch) {
+                        break;
+                    }
+
+                    std::this_thread::yield();
+                }
+            }
+
+            detail::heavy_fence();
+            retired.swap(retired_);
+        }
+
+        reclaim(retired);
+    }
+
+    // ptr must already be unreachable to new readers. may be called from a
+    // read-side critical section; a full backlog is then left for the next
+    // synchronize() or retire() outside of one
+    void retire(void *ptr, void (*deleter)(void*)) {
+        bool is_full;
+
+        {
+            std::scoped_lock lock{ mutex_ };
+            retired_.push_back(Retired{ ptr, deleter });
+            is_full = retired_.size() >= MAX_RETIRED;
+        }
+
+        if (is_full && this_reader().depth == 0) {
+            synchronize();
+        }
+    }
+
+    template <typename T>
+    void retire(T *ptr) {
+        retire(ptr, [](void *p) { delete static_cast<T*>(p); });
+    }
+};
+
+} // namespace locking
+
+#endif
@@ -32,9 +32,11 @@
 #ifndef LOCKING_SPINLOCK_HPP
 #define LOCKING_SPINLOCK_HPP
 
+#include <locking/detail/thread_state.hpp>
 #include <locking/type_traits.hpp>
 
 #include <atomic>
+#include <thread>
 
 namespace locking {
 
@@ -66,6 +68,57 @@ public:
     }
 };
 
+// yields instead of spinning while the holder is off-CPU
+class OwnerAwareSpinlock {
+private:
+    std::atomic_flag is_locked_ = ATOMIC_FLAG_INIT;
+    std::atomic<detail::ThreadState*> owner_ = nullptr;
+
+    void set_owner() {
+        auto &self = detail::ThreadState::current();
+        self.set_running();
+        owner_.store(&self, std::memory_order_relaxed);
+    }
+
+public:
+    OwnerAwareSpinlock() = default;
+
+    OwnerAwareSpinlock(const OwnerAwareSpinlock &other) = delete;
+
+    OwnerAwareSpinlock(OwnerAwareSpinlock &&other) = delete;
+
+    OwnerAwareSpinlock& operator=(const OwnerAwareSpinlock &other) = delete;
+
+    OwnerAwareSpinlock& operator=(OwnerAwareSpinlock &&other) = delete;
+
+    void lock() {
+        while (is_locked_.test_and_set()) {
+            const auto owner = owner_.load(std::memory_order_relaxed);
+
+            if (owner && !owner->is_running()) {
+                std::this_thread::yield();
+            }
+        }
+
+        set_owner();
+    }
+
+    bool try_lock() {
+        if (is_locked_.test_and_set()) {
+            return false;
+        }
+
+        set_owner();
+
+        return true;
+    }
+
+    void unlock() noexcept {
+        owner_.store(nullptr, std::memory_order_relaxed);
+        is_locked_.clear();
+    }
+};
+
 } // namespace locking
 
 #endif
@@ -59,6 +59,20 @@ struct IsMutex : detail::IsMutexHelper<T>::Type { };
 template <typename T>
 inline constexpr bool IS_MUTEX = IsMutex<T>::value;
 
+// https://en.cppreference.com/w/cpp/named_req/SharedMutex
+template <typename T>
+struct IsSharedMutex : detail::IsSharedMutexHelper<T>::Type { };
+
+template <typename T>
+inline constexpr bool IS_SHARED_MUTEX = IsSharedMutex<T>::value;
+
+// a SharedMutex that also has Boost.Thread's upgrade ownership
+template <typename T>
+struct IsUpgradeableMutex : detail::IsUpgradeableMutexHelper<T>::Type { };
+
+template <typename T>
+inline constexpr bool IS_UPGRADEABLE_MUTEX = IsUpgradeableMutex<T>::value;
+
 template <typename T>
 struct IsArithmetic : detail::IsArithmetic<T> { };
 
@@ -0,0 +1,336 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproducne the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LOCKING_UPGRADEABLE_SHARED_MUTEX_HPP
+#define LOCKING_UPGRADEABLE_SHARED_MUTEX_HPP
+
+#include <locking/detail/futex.hpp>
+#include <locking/detail/predictor.hpp>
+#include <locking/type_traits.hpp>
+
+#include <cstdint>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+namespace locking {
+
+// an upgradeable owner coexists with shared owners but excludes other
+// upgradeable and exclusive owners, so it can upgrade without a second lookup
+template <typename C = std::chrono::steady_clock>
+class UpgradeableSharedMutex {
+private:
+    static constexpr std::uint32_t WRITER = 1;
+    static constexpr std::uint32_t UPGRADER = 2;
+    static constexpr std::uint32_t PENDING = 4;
+    static constexpr std::uint32_t WAITERS = 8;
+    static constexpr std::uint32_t READER = 16;
+
+    std::atomic<std::uint32_t> state_ = 0;
+    detail::Predictor<C> predictor_{ };
+
+    template <typename F>
+    bool try_transition(std::uint32_t &observed, F &&next) noexcept {
+        observed = state_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            const auto desired = next(observed);
+
+            if (desired == observed) {
+                return false;
+            }
+
+            if (state_.compare_exchange_weak(observed, desired,
+                                             std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    template <typename F>
+    void transition(F &&next) {
+        std::uint32_t observed = 0;
+
+        predictor_.wait([this, &observed, &next] {
+            return try_transition(observed, next);
+        }, [this, &observed] {
+            park(observed);
+        });
+    }
+
+    void park(std::uint32_t observed) noexcept {
+        if (!(observed & WAITERS)
+            && !state_.compare_exchange_strong(observed, observed | WAITERS,
+                                               std::memory_order_relaxed)) {
+            return;
+        }
+
+        detail::futex_wait(state_, observed | WAITERS);
+    }
+
+    void release(std::uint32_t clear, std::uint32_t add) noexcept {
+        auto observed = state_.load(std::memory_order_relaxed);
+
+        while (!state_.compare_exchange_weak(
+            observed, (observed & ~(clear | WAITERS)) + add,
+            std::memory_order_release, std::memory_order_relaxed
+        )) { }
+
+        if (observed & WAITERS) {
+            detail::futex_wake(state_);
+        }
+    }
+
+    static std::uint32_t exclusive(std::uint32_t state) noexcept {
+        return (state & ~WAITERS) ? state : state | WRITER;
+    }
+
+    static std::uint32_t shared(std::uint32_t state) noexcept {
+        return (state & (WRITER | PENDING)) ? state : state + READER;
+    }
+
+    static std::uint32_t upgradeable(std::uint32_t state) noexcept {
+        return (state & (WRITER | UPGRADER)) ? state : state | UPGRADER;
+    }
+
+    static std::uint32_t upgraded(std::uint32_t state) noexcept {
+        return (state >= READER) ? state : (state & WAITERS) | WRITER;
+    }
+
+public:
+    UpgradeableSharedMutex() = default;
+
+    UpgradeableSharedMutex(const UpgradeableSharedMutex &other) = delete;
+
+    UpgradeableSharedMutex(UpgradeableSharedMutex &&other) = delete;
+
+    UpgradeableSharedMutex&
+    operator=(const UpgradeableSharedMutex &other) = delete;
+
+    UpgradeableSharedMutex& operator=(UpgradeableSharedMutex &&other) = delete;
+
+    void lock() {
+        transition(exclusive);
+    }
+
+    bool try_lock() noexcept {
+        std::uint32_t observed;
+
+        return try_transition(observed, exclusive);
+    }
+
+    void unlock() noexcept {
+        release(WRITER, 0);
+    }
+
+    void lock_shared() {
+        transition(shared);
+    }
+
+    bool try_lock_shared() noexcept {
+        std::uint32_t observed;
+
+        return try_transition(observed, shared);
+    }
+
+    // only the last shared owner out can unblock a waiter. it clears WAITERS
+    // in the same RMW that drops its share, since a writer may take, release
+    // and destroy the mutex as soon as that lands
+    void unlock_shared() noexcept {
+        auto observed = state_.load(std::memory_order_relaxed);
+
+        while (!state_.compare_exchange_weak(
+            observed,
+            (observed < 2 * READER) ? (observed & ~WAITERS) - READER
+                                    : observed - READER,
+            std::memory_order_release, std::memory_order_relaxed
+        )) { }
+
+        if ((observed & WAITERS) && observed < 2 * READER) {
+            detail::futex_wake(state_);
+        }
+    }
+
+    void lock_upgrade() {
+        transition(upgradeable);
+    }
+
+    bool try_lock_upgrade() noexcept {
+        std::uint32_t observed;
+
+        return try_transition(observed, upgradeable);
+    }
+
+    void unlock_upgrade() noexcept {
+        release(UPGRADER, 0);
+    }
+
+    // blocks new shared owners until the existing ones drain
+    void unlock_upgrade_and_lock() {
+        state_.fetch_or(PENDING, std::memory_order_relaxed);
+        transition(upgraded);
+    }
+
+    bool try_unlock_upgrade_and_lock() noexcept {
+        std::uint32_t observed;
+
+        return try_transition(observed, upgraded);
+    }
+
+    void unlock_and_lock_upgrade() noexcept {
+        release(WRITER, UPGRADER);
+    }
+
+    void unlock_and_lock_shared() noexcept {
+        release(WRITER, READER);
+    }
+
+    void unlock_upgrade_and_lock_shared() noexcept {
+        release(UPGRADER, READER);
+    }
+};
+
+template <typename M>
+class UpgradeLock {
+private:
+    M *mutex_ = nullptr;
+    bool owns_ = false;
+
+public:
+    static_assert(IS_UPGRADEABLE_MUTEX<M>, "M must be an UpgradeableMutex type");
+
+    using mutex_type = M;
+
+    UpgradeLock() noexcept = default;
+
+    explicit UpgradeLock(M &mutex) : mutex_{ &mutex } {
+        lock();
+    }
+
+    UpgradeLock(M &mutex, std::defer_lock_t) noexcept : mutex_{ &mutex } { }
+
+    UpgradeLock(M &mutex, std::try_to_lock_t) : mutex_{ &mutex } {
+        try_lock();
+    }
+
+    UpgradeLock(M &mutex, std::adopt_lock_t) noexcept
+    : mutex_{ &mutex }, owns_{ true } { }
+
+    explicit UpgradeLock(std::unique_lock<M> &&lock) {
+        if (lock.owns_lock()) {
+            lock.mutex()->unlock_and_lock_upgrade();
+            owns_ = true;
+        }
+
+        mutex_ = lock.release();
+    }
+
+    UpgradeLock(const UpgradeLock &other) = delete;
+
+    UpgradeLock(UpgradeLock &&other) noexcept
+    : mutex_{ std::exchange(other.mutex_, nullptr) },
+      owns_{ std::exchange(other.owns_, false) } { }
+
+    ~UpgradeLock() {
+        if (owns_) {
+            mutex_->unlock_upgrade();
+        }
+    }
+
+    UpgradeLock& operator=(const UpgradeLock &other) = delete;
+
+    UpgradeLock& operator=(UpgradeLock &&other) noexcept {
+        if (owns_) {
+            mutex_->unlock_upgrade();
+        }
+
+        mutex_ = std::exchange(other.mutex_, nullptr);
+        owns_ = std::exchange(other.owns_, false);
+
+        return *this;
+    }
+
+    void lock() {
+        mutex_->lock_upgrade();
+        owns_ = true;
+    }
+
+    bool try_lock() {
+        owns_ = mutex_->try_lock_upgrade();
+
+        return owns_;
+    }
+
+    void unlock() {
+        mutex_->unlock_upgrade();
+        owns_ = false;
+    }
+
+    std::unique_lock<M> upgrade() {
+        mutex_->unlock_upgrade_and_lock();
+        owns_ = false;
+
+        return std::unique_lock<M>{ *mutex_, std::adopt_lock };
+    }
+
+    std::shared_lock<M> downgrade() {
+        mutex_->unlock_upgrade_and_lock_shared();
+        owns_ = false;
+
+        return std::shared_lock<M>{ *mutex_, std::adopt_lock };
+    }
+
+    M* release() noexcept {
+        owns_ = false;
+
+        return std::exchange(mutex_, nullptr);
+    }
+
+    M* mutex() const noexcept {
+        return mutex_;
+    }
+
+    bool owns_lock() const noexcept {
+        return owns_;
+    }
+
+    explicit operator bool() const noexcept {
+        return owns_;
+    }
+};
+
+} // namespace locking
+
+#endif
@@ -30,8 +30,14 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 #include <locking/adaptive_mutex.hpp>
+#include <locking/biased_lock.hpp>
+#include <locking/pi_mutex.hpp>
+#include <locking/rcu.hpp>
+#include <locking/recursive_adaptive_mutex.hpp>
+#include <locking/recursive_spinlock.hpp>
 #include <locking/spinlock.hpp>
 #include <locking/type_traits.hpp>
+#include <locking/upgradeable_shared_mutex.hpp>
 
 #include <chrono>
 #include <mutex>
@@ -77,8 +83,22 @@ static_assert(IS_BASIC_LOCKABLE<BasicLock>, "BasicLock must be BasicLockable");
 static_assert(IS_BASIC_LOCKABLE<Lock>, "Lock must be BasicLockable");
 static_assert(IS_BASIC_LOCKABLE<Mutex>, "Mutex must be BasicLockable");
 static_assert(IS_BASIC_LOCKABLE<Spinlock>, "Spinlock must be BasicLockable");
+static_assert(IS_BASIC_LOCKABLE<OwnerAwareSpinlock>,
+              "OwnerAwareSpinlock must be BasicLockable");
 static_assert(IS_BASIC_LOCKABLE<AdaptiveMutex<>>,
               "AdaptiveMutex<> must be BasicLockable");
+static_assert(IS_BASIC_LOCKABLE<BiasedLock<>>,
+              "BiasedLock<> must be BasicLockable");
+static_assert(IS_BASIC_LOCKABLE<PiMutex>, "PiMutex must be BasicLockable");
+static_assert(IS_BASIC_LOCKABLE<AdaptiveMutex<PiMutex>>,
+              "AdaptiveMutex<PiMutex> must be BasicLockable");
+static_assert(IS_BASIC_LOCKABLE<RecursiveSpinlock>,
+              "RecursiveSpinlock must be BasicLockable");
+static_assert(IS_BASIC_LOCKABLE<RecursiveAdaptiveMutex<>>,
+              "RecursiveAdaptiveMutex<> must be BasicLockable");
+static_assert(IS_BASIC_LOCKABLE<UpgradeableSharedMutex<>>,
+              "UpgradeableSharedMutex<> must be BasicLockable");
+static_assert(IS_BASIC_LOCKABLE<Rcu<>>, "Rcu<> must be BasicLockable");
 static_assert(IS_BASIC_LOCKABLE<std::mutex>,
               "std::mutex must be BasicLockable");
 static_assert(IS_BASIC_LOCKABLE<std::timed_mutex>,
@@ -101,7 +121,19 @@ static_assert(!IS_BASIC_LOCKABLE<double>, "double must not be BasicLockable");
 static_assert(IS_LOCKABLE<Lock>, "Lock must be Lockable");
 static_assert(IS_LOCKABLE<Mutex>, "Mutex must be Lockable");
 static_assert(IS_LOCKABLE<Spinlock>, "Spinlock must be Lockable");
+static_assert(IS_LOCKABLE<OwnerAwareSpinlock>,
+              "OwnerAwareSpinlock must be Lockable");
 static_assert(IS_LOCKABLE<AdaptiveMutex<>>, "AdaptiveMutex<> must be Lockable");
+static_assert(IS_LOCKABLE<BiasedLock<>>, "BiasedLock<> must be Lockable");
+static_assert(IS_LOCKABLE<PiMutex>, "PiMutex must be Lockable");
+static_assert(IS_LOCKABLE<AdaptiveMutex<PiMutex>>,
+              "AdaptiveMutex<PiMutex> must be Lockable");
+static_assert(IS_LOCKABLE<RecursiveSpinlock>,
+              "RecursiveSpinlock must be Lockable");
+static_assert(IS_LOCKABLE<RecursiveAdaptiveMutex<>>,
+              "RecursiveAdaptiveMutex<> must be Lockable");
+static_assert(IS_LOCKABLE<UpgradeableSharedMutex<>>,
+              "UpgradeableSharedMutex<> must be Lockable");
 static_assert(IS_LOCKABLE<std::mutex>,
               "std::mutex must be Lockable");
 static_assert(IS_LOCKABLE<std::timed_mutex>,
@@ -116,6 +148,7 @@ static_assert(IS_LOCKABLE<std::shared_timed_mutex>,
               "std::shared_timed_mutex must be Lockable");
 
 static_assert(!IS_LOCKABLE<BasicLock>, "BasicLock must not be Lockable");
+static_assert(!IS_LOCKABLE<Rcu<>>, "Rcu<> must not be Lockable");
 static_assert(!IS_LOCKABLE<void>, "void must not be Lockable");
 static_assert(!IS_LOCKABLE<int>, "int must not be Lockable");
 static_assert(!IS_LOCKABLE<double>, "double must not be Lockable");
@@ -124,7 +157,23 @@ static_assert(!IS_LOCKABLE<double>, "double must not be Lockable");
 // IsMutex
 static_assert(IS_MUTEX<Mutex>, "Mutex must be a Mutex");
 static_assert(IS_MUTEX<Spinlock>, "Spinlock must be a Mutex");
+static_assert(IS_MUTEX<OwnerAwareSpinlock>,
+              "OwnerAwareSpinlock must be a Mutex");
 static_assert(IS_MUTEX<AdaptiveMutex<>>, "AdaptiveMutex<> must be a Mutex");
+static_assert(IS_MUTEX<BiasedLock<>>, "BiasedLock<> must be a Mutex");
+static_assert(IS_MUTEX<BiasedLock<Spinlock>>,
+              "BiasedLock<Spinlock> must be a Mutex");
+static_assert(IS_MUTEX<PiMutex>, "PiMutex must be a Mutex");
+static_assert(IS_MUTEX<AdaptiveMutex<PiMutex>>,
+              "AdaptiveMutex<PiMutex> must be a Mutex");
+static_assert(IS_MUTEX<AdaptiveMutex<std::mutex, std::chrono::steady_clock,
+                                    StarvationPolicy>>,
+              "AdaptiveMutex<..., StarvationPolicy> must be a Mutex");
+static_assert(IS_MUTEX<RecursiveSpinlock>, "RecursiveSpinlock must be a Mutex");
+static_assert(IS_MUTEX<RecursiveAdaptiveMutex<>>,
+              "RecursiveAdaptiveMutex<> must be a Mutex");
+static_assert(IS_MUTEX<UpgradeableSharedMutex<>>,
+              "UpgradeableSharedMutex<> must be a Mutex");
 static_assert(IS_MUTEX<std::mutex>,
               "std::mutex must be a Mutex");
 static_assert(IS_MUTEX<std::timed_mutex>,
@@ -145,6 +194,37 @@ static_assert(!IS_MUTEX<int>, "int must not be a Mutex");
 static_assert(!IS_MUTEX<double>, "double must not be a Mutex");
 
 
+// IsSharedMutex
+static_assert(IS_SHARED_MUTEX<UpgradeableSharedMutex<>>,
+              "UpgradeableSharedMutex<> must be a SharedMutex");
+static_assert(IS_SHARED_MUTEX<std::shared_mutex>,
+              "std::shared_mutex must be a SharedMutex");
+static_assert(IS_SHARED_MUTEX<std::shared_timed_mutex>,
+              "std::shared_timed_mutex must be a SharedMutex");
+
+static_assert(!IS_SHARED_MUTEX<Mutex>, "Mutex must not be a SharedMutex");
+static_assert(!IS_SHARED_MUTEX<Spinlock>,
+              "Spinlock must not be a SharedMutex");
+static_assert(!IS_SHARED_MUTEX<std::mutex>,
+              "std::mutex must not be a SharedMutex");
+static_assert(!IS_SHARED_MUTEX<void>, "void must not be a SharedMutex");
+static_assert(!IS_SHARED_MUTEX<int>, "int must not be a SharedMutex");
+
+
+// IsUpgradeableMutex
+static_assert(IS_UPGRADEABLE_MUTEX<UpgradeableSharedMutex<>>,
+              "UpgradeableSharedMutex<> must be an UpgradeableMutex");
+
+static_assert(!IS_UPGRADEABLE_MUTEX<std::shared_mutex>,
+              "std::shared_mutex must not be an UpgradeableMutex");
+static_assert(!IS_UPGRADEABLE_MUTEX<std::mutex>,
+              "std::mutex must not be an UpgradeableMutex");
+static_assert(!IS_UPGRADEABLE_MUTEX<void>,
+              "void must not be an UpgradeableMutex");
+static_assert(!IS_UPGRADEABLE_MUTEX<int>,
+              "int must not be an UpgradeableMutex");
+
+
 // IsArithmetic
 static_assert(IS_ARITHMETIC<char>, "char must be Arithmetic");
 static_assert(IS_ARITHMETIC<short>, "short must be Arithmetic");